@@ -247,7 +247,7 @@ void QueryModel<Result>::invalidateRow(int row)
 
   WModelIndex start = index(row, 0);
   WModelIndex end = index(row, columnCount() - 1);
-  dataChanged().emit(start, end);
+  emitDataChanged(start, end);
 }
 
 template <class Result>
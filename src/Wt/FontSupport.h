@@ -24,7 +24,7 @@ namespace Wt {
  * available, otherwise uses a simple font matching which choses a
  * single font and does not take into account its supported glyphs.
  */
-class FontSupport
+class WT_API FontSupport
 {
 public:
   class Bitmap {
@@ -144,9 +144,31 @@ public:
    */
   void addFontCollection(const std::string& directory, bool recursive = true);
 
+  /*
+   * Sets the size (in bytes) of the process-wide cache of measured
+   * text widths, which is shared by all instances. The default size
+   * is 1 MB.
+   */
+  static void setMeasureCacheSize(std::size_t bytes);
+
+  /*
+   * Clears the process-wide cache of measured text widths.
+   */
+  static void clearMeasureCache();
+
 private:
   WPaintDevice *device_;
 
+  /*
+   * Identifies how text is measured: by which kind of device, and
+   * with which fonts available.
+   */
+  std::string deviceKey() const;
+
+  std::string measureKey(const WFont& font, const std::string& utf8) const;
+  static bool cachedWidth(const std::string& key, double& width);
+  static void cacheWidth(const std::string& key, double width);
+
 #ifdef HAVE_PANGO
 
   PangoContext *context_;
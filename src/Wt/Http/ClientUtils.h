@@ -0,0 +1,34 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2012 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_HTTP_CLIENT_UTILS_H_
+#define WT_HTTP_CLIENT_UTILS_H_
+
+#include <Wt/WDllDefs.h>
+
+#include <string>
+
+namespace Wt {
+
+  class WIOService;
+
+  namespace Http {
+
+    // Inspects the connection pool which the clients of an I/O
+    // service share
+    class WT_API ClientUtils
+    {
+    public:
+      // Returns whether the resolved addresses of a "host:port" are
+      // cached
+      static bool hasCachedEndpoints(WIOService& ioService,
+				     const std::string& hostPort);
+    };
+
+  }
+}
+
+#endif // WT_HTTP_CLIENT_UTILS_H_
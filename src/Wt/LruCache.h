@@ -0,0 +1,145 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2012 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef LRU_CACHE_H_
+#define LRU_CACHE_H_
+
+#include <list>
+#include <map>
+
+namespace Wt {
+
+/*
+ * A map which keeps its entries in least-recently-used order, for
+ * caches that are bounded in size.
+ *
+ * Each entry has a cost (e.g. its size in bytes), and prune() removes
+ * the least recently used entries until the total cost is within a
+ * bound. find() marks an entry as most recently used.
+ *
+ * The cache is not thread-safe: a cache that is shared between
+ * sessions is protected by a mutex of its owner.
+ */
+template <typename Key, typename Value>
+class LruCache
+{
+public:
+  LruCache()
+    : cost_(0)
+  { }
+
+  /*
+   * Returns the value for a key, and marks it as most recently used,
+   * or 0 if the key is not cached.
+   */
+  Value *find(const Key& key)
+  {
+    typename EntryMap::iterator i = entries_.find(key);
+
+    if (i != entries_.end()) {
+      lru_.splice(lru_.begin(), lru_, i->second);
+      return &i->second->value;
+    } else
+      return 0;
+  }
+
+  /*
+   * Returns whether a key is cached, without marking it as used.
+   */
+  bool contains(const Key& key) const
+  {
+    return entries_.find(key) != entries_.end();
+  }
+
+  /*
+   * Inserts (or replaces) a value as the most recently used entry.
+   */
+  void insert(const Key& key, const Value& value, std::size_t cost = 1)
+  {
+    remove(key);
+
+    lru_.push_front(Entry(key, value, cost));
+    entries_[key] = lru_.begin();
+    cost_ += cost;
+  }
+
+  bool remove(const Key& key)
+  {
+    typename EntryMap::iterator i = entries_.find(key);
+
+    if (i != entries_.end()) {
+      remove(i);
+      return true;
+    } else
+      return false;
+  }
+
+  /*
+   * Removes all entries for which pred(key, value) is true.
+   */
+  template <typename Predicate>
+  void removeIf(Predicate pred)
+  {
+    for (typename EntryMap::iterator i = entries_.begin();
+	 i != entries_.end();)
+      if (pred(i->first, i->second->value))
+	remove(i++);
+      else
+	++i;
+  }
+
+  /*
+   * Removes the least recently used entries until the total cost is
+   * at most maxCost, but keeps the keep most recently used entries.
+   */
+  void prune(std::size_t maxCost, std::size_t keep = 0)
+  {
+    while (cost_ > maxCost && entries_.size() > keep)
+      remove(entries_.find(lru_.back().key));
+  }
+
+  void clear()
+  {
+    lru_.clear();
+    entries_.clear();
+    cost_ = 0;
+  }
+
+  // The number of entries
+  std::size_t size() const { return entries_.size(); }
+
+  // The total cost of the entries
+  std::size_t cost() const { return cost_; }
+
+private:
+  struct Entry {
+    Entry(const Key& k, const Value& v, std::size_t c)
+      : key(k), value(v), cost(c)
+    { }
+
+    Key key;
+    Value value;
+    std::size_t cost;
+  };
+
+  typedef std::list<Entry> EntryList;
+  typedef std::map<Key, typename EntryList::iterator> EntryMap;
+
+  EntryList lru_;
+  EntryMap entries_;
+  std::size_t cost_;
+
+  void remove(typename EntryMap::iterator i)
+  {
+    cost_ -= i->second->cost;
+    lru_.erase(i->second);
+    entries_.erase(i);
+  }
+};
+
+}
+
+#endif // LRU_CACHE_H_
@@ -0,0 +1,52 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2012 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef PAINT_CACHE_RESOURCE_H_
+#define PAINT_CACHE_RESOURCE_H_
+
+#include "Wt/WPaintCache"
+#include "Wt/WResource"
+
+#ifdef WT_THREADED
+#include <boost/thread/mutex.hpp>
+#endif // WT_THREADED
+
+namespace Wt {
+
+/*
+ * Serves a cached PNG rendering (see WPaintedWidget::setRenderCacheKey()),
+ * with an ETag.
+ *
+ * The URL only changes when the entry changes, so that the browser
+ * may keep using (or validate) its cached copy.
+ */
+class WT_API PaintCacheResource : public WResource
+{
+public:
+  PaintCacheResource(WObject *parent = 0);
+  virtual ~PaintCacheResource();
+
+  void setEntry(const WPaintCache::EntryPtr& entry);
+  WPaintCache::EntryPtr entry() const;
+
+  virtual void handleRequest(const Http::Request& request,
+			     Http::Response& response);
+
+private:
+  /*
+   * The entry is set by the session, while a request may be served
+   * concurrently
+   */
+#ifdef WT_THREADED
+  mutable boost::mutex entryMutex_;
+#endif // WT_THREADED
+
+  WPaintCache::EntryPtr entry_;
+};
+
+}
+
+#endif // PAINT_CACHE_RESOURCE_H_
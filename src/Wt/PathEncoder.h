@@ -0,0 +1,74 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2012 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef PATH_ENCODER_H_
+#define PATH_ENCODER_H_
+
+#include <string>
+
+#include "Wt/WDllDefs.h"
+#include "Wt/WPointF"
+
+namespace Wt {
+
+class WStringStream;
+
+/*
+ * Packs path segments in a compact string that is replayed by
+ * Wt.gfxPath() in the browser.
+ *
+ * Each segment is written as an operation code followed by its
+ * points. Coordinates are rounded to thousandths of a pixel (the
+ * same precision as the plain script output) and written as the
+ * difference against the previous coordinate, which is usually
+ * small for chart data. All numbers are written as zigzag varints
+ * in a base64 alphabet, with 5 bits per character and 0x20 as the
+ * continuation bit.
+ *
+ * A segment with a point that is not finite is skipped, as the
+ * browser ignores it as well, and coordinates are clamped to
+ * +/- MAX_COORDINATE, so that the deltas are exact in JavaScript.
+ */
+class WT_API PathEncoder
+{
+public:
+  enum Op { MoveOp = 0, LineOp = 1, CurveOp = 2 };
+
+  static const double MAX_COORDINATE;
+
+  PathEncoder(const WPointF& translation = WPointF());
+
+  void moveTo(double x, double y);
+  void lineTo(double x, double y);
+  void curveTo(double c1x, double c1y, double c2x, double c2y,
+	       double x, double y);
+
+  /*
+   * Writes the pending segments, if any, as a single call. The
+   * deltas restart from the origin for the next call.
+   */
+  void flush(WStringStream& out);
+
+  // The pending segments
+  const std::string& data() const { return data_; }
+
+  // Encodes a single number
+  static void writeNumber(std::string& out, long long v);
+
+  static long long toFixed(double v);
+
+private:
+  WPointF translation_;
+  long long x_, y_;
+  std::string data_;
+
+  bool isFinite(double x, double y) const;
+  void writePoint(double x, double y);
+};
+
+}
+
+#endif // PATH_ENCODER_H_
@@ -0,0 +1,29 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2012 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_RANDOM_UTILS_H_
+#define WT_RANDOM_UTILS_H_
+
+#include <Wt/WDllDefs.h>
+
+#include <boost/cstdint.hpp>
+
+namespace Wt {
+  namespace RandomUtils {
+
+    // The number of times a generator of WRandom was (re)seeded with
+    // entropy from the operating system, in this process
+    extern WT_API unsigned seedCount();
+
+    // The ChaCha20 block function (RFC 7539, section 2.3), which
+    // WRandom uses to generate its key stream
+    extern WT_API void chacha20Block(const boost::uint32_t input[16],
+				     boost::uint32_t output[16]);
+
+  }
+}
+
+#endif // WT_RANDOM_UTILS_H_
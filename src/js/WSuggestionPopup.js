@@ -29,7 +29,7 @@ WT_DECLARE_WT_MEMBER
 
    var selId = null, editId = null, kd = false,
        filter = null, filtering = null, delayHideTimeout = null,
-       lastFilterValue = null, droppedDown = false;
+       lastFilterValue = null, droppedDown = false, indexed = false;
 
    this.defaultValue = defaultValue;
 
@@ -217,8 +217,13 @@ WT_DECLARE_WT_MEMBER
      return (event.keyCode != key_enter && event.keyCode != key_tab);
    };
 
-   this.filtered = function(f) {
+   /*
+    * When all, the suggestions all match the filter (see
+    * WSuggestionPopup::setFilterIndex())
+    */
+   this.filtered = function(f, all) {
      filter = f;
+     indexed = all ? true : false;
      self.refilter();
    };
 
@@ -265,7 +270,8 @@ WT_DECLARE_WT_MEMBER
      }
 
      var first = null, toselect = null,
-         showall = droppedDown && text.length == 0,
+         showall = (droppedDown && text.length == 0)
+           || (indexed && text == filter),
          i, il;
 
      for (i = 0, il = sels.length; i < il; ++i) {
@@ -167,6 +167,69 @@ WT_DECLARE_WT_MEMBER
      scrollY2 = Y2;
    };
 
+   /*
+    * Client-side rendering: first inserts 'shift' cells at the top of
+    * each rendered column (or removes them when 'shift' is negative),
+    * and adjusts each column to hold 'rowCount' cells. Then sets the
+    * data for the rendered rows from rendered row 'start' onwards, and
+    * for the rendered columns from rendered column 'column' onwards
+    * (row header columns first). Existing cells are reused.
+    */
+   this.setData = function(rowCount, shift, start, column, rows) {
+     var h = rowHeight() + 'px',
+         containers = [ headerColumnsContainer, contentsContainer ],
+         columns = [], i, il, j, jl;
+
+     function createCell() {
+       var cell = document.createElement('div');
+       cell.className = 'Wt-tv-c';
+       cell.style.height = h;
+       cell.appendChild(document.createTextNode(''));
+       return cell;
+     }
+
+     for (i = 0; i < 2; ++i) {
+       var c = containers[i].firstChild.firstChild.childNodes;
+       for (j = 0, jl = c.length; j < jl; ++j)
+	 columns.push(c[j]);
+     }
+
+     for (j = 0, jl = columns.length; j < jl; ++j) {
+       var col = columns[j], cells = col.childNodes, cell;
+
+       if (cells.length > 0) {
+	 for (i = shift; i < 0 && cells.length > 0; ++i)
+	   col.removeChild(col.firstChild);
+	 for (i = 0; i < shift; ++i)
+	   col.insertBefore(createCell(), col.firstChild);
+       }
+
+       while (cells.length > rowCount)
+	 col.removeChild(col.lastChild);
+
+       while (cells.length < rowCount)
+	 col.appendChild(createCell());
+
+       if (j < column)
+	 continue;
+
+       for (i = 0, il = rows.length; i < il && start + i < rowCount; ++i) {
+	 var d = rows[i][j - column];
+	 if (d === undefined)
+	   break;
+
+	 cell = cells[start + i];
+	 if (typeof d === 'string') {
+	   cell.firstChild.nodeValue = d;
+	   cell.className = 'Wt-tv-c';
+	 } else {
+	   cell.firstChild.nodeValue = d[0];
+	   cell.className = 'Wt-tv-c ' + d[1];
+	 }
+       }
+     }
+   };
+
    this.resetScroll = function() {
      headerContainer.scrollLeft = scrollLeft;
      contentsContainer.scrollLeft = scrollLeft;
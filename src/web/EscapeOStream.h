@@ -35,6 +35,7 @@ public:
   EscapeOStream& operator<< (const char *s);
   EscapeOStream& operator<< (const std::string& s);
   EscapeOStream& operator<< (int);
+  EscapeOStream& operator<< (double);
   EscapeOStream& operator<< (const EscapeOStream& other);
 
   const char *c_str(); // for default constructor, can return 0
@@ -182,8 +182,19 @@ inline const T& last(const std::set<T>& s)
   return *s.rbegin();
 }
 
-// Fast round and format to string routine
+// Fast round and format to string routines, which do not depend on
+// the locale. round_str() formats exactly the given number of decimals,
+// round_css_str() and round_js_str() omit trailing zero decimals and
+// format a valid CSS or JavaScript number for NaN or infinity
 extern char *round_str(double d, int digits, char *buf);
+extern char *round_css_str(double d, int digits, char *buf);
+extern char *round_js_str(double d, int digits, char *buf);
+
+// Fast shortest representation, as a JavaScript number, with at most
+// precision (1 - 17) significant digits: with 17 digits it always parses
+// back to the same number, with 15 digits any decimal number of up to 15
+// digits is printed as such, without the noise of binary rounding
+extern char *shortest_str(double d, char *buf, int precision = 17);
 
 // Only for Java target
 extern std::string toHexString(int i);
@@ -48,6 +48,45 @@ this.condCall = function(o, f, a) {
     o[f](a);
 };
 
+/*
+ * Replays a path encoded by WCanvasPaintDevice on a 2D canvas context.
+ *
+ * The path is a base64 string of zigzag varints (5 bits per character,
+ * 0x20 is the continuation bit): an operation (0 = moveTo, 1 = lineTo,
+ * 2 = bezierCurveTo) followed by its points, with every coordinate
+ * given in thousandths as a delta against the previous coordinate.
+ */
+this.gfxPath = function(ctx, s) {
+  var B = 'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/',
+    i = 0, il = s.length, x = 0, y = 0;
+
+  function next() {
+    var v = 0, m = 1, c;
+    do {
+      c = B.indexOf(s.charAt(i++));
+      v += (c & 31) * m;
+      m *= 32;
+    } while (c & 32);
+    return (v % 2) ? -(v + 1) / 2 : v / 2;
+  }
+
+  while (i < il) {
+    var op = next(), p = [];
+    for (var j = 0, jl = (op == 2 ? 3 : 1); j < jl; ++j) {
+      x += next();
+      y += next();
+      p.push(x / 1000, y / 1000);
+    }
+
+    if (op == 0)
+      ctx.moveTo(p[0], p[1]);
+    else if (op == 1)
+      ctx.lineTo(p[0], p[1]);
+    else
+      ctx.bezierCurveTo(p[0], p[1], p[2], p[3], p[4], p[5]);
+  }
+};
+
 // buttons currently down
 this.buttons = 0;
 
@@ -18,7 +18,7 @@ window.WT_DECLARE_APP_MEMBER=function(M,N,F,L){var P=window.currentApp;if(N==Jav
 if(!window._$_WT_CLASS_$_)window._$_WT_CLASS_$_=new (function(){function M(a){return a.split("/")[2]}function N(a,b,c){if(a=="auto"||a==null)return c;return(a=(a=b.exec(a))&&a.length==2?a[1]:null)?parseFloat(a):c}function F(a,b){return N(a,/^\s*(-?\d+(?:\.\d+)?)\s*\%\s*$/i,b)}function L(a){if(H==null)return null;if(!a)a=window.event;if(a){for(var b=a=g.target(a);b&&b!=H;)b=b.parentNode;return b==H?g.isIElt9?a:null:H}else return H}function P(a){var b=L(a);if(b&&!X){if(!a)a=window.event;X=true;if(g.isIElt9){g.firedTarget=
 a.srcElement||b;b.fireEvent("onmousemove",a);g.firedTarget=null}else g.condCall(b,"onmousemove",a);return X=false}else return true}function Y(a){var b=L(a);g.capture(null);if(b){if(!a)a=window.event;if(g.isIElt9){g.firedTarget=a.srcElement||b;b.fireEvent("onmouseup",a);g.firedTarget=null}else g.condCall(b,"onmouseup",a);g.cancelEvent(a,g.CancelPropagate);return false}else return true}function ja(){if(!ea){ea=true;if(document.body.addEventListener){var a=document.body;a.addEventListener("mousemove",
 P,true);a.addEventListener("mouseup",Y,true);g.isGecko&&window.addEventListener("mouseout",function(b){!b.relatedTarget&&g.hasTag(b.target,"HTML")&&Y(b)},true)}else{a=document.body;a.attachEvent("onmousemove",P);a.attachEvent("onmouseup",Y)}}}function fa(){if(!Q){var a,b,c=document.styleSheets;a=0;for(b=c.length;a<b;++a){var h=c[a];if(g.hasTag(c[a].ownerNode,"STYLE")){Q=h;break}}if(!Q){h=document.createElement("style");document.getElementsByTagName("head")[0].appendChild(h);Q=h.sheet}}return Q}function ga(a){return a.replace(/%/g,
-"%25").replace(/\+/g,"%2b").replace(/ /g,"%20").replace(/#/g,"%23").replace(/&/g,"%26")}var g=this;this.condCall=function(a,b,c){a[b]&&a[b](c)};this.buttons=0;this.button=function(a){return a.which?a.which==3?4:a.which==2?2:1:g.isIE&&typeof a.button!="undefined"?a.button==2?4:a.button==4?2:1:typeof a.button!="undefined"?a.button==2?4:a.button==1?2:1:0};this.mouseDown=function(a){g.buttons|=g.button(a)};this.mouseUp=function(a){g.buttons&=~g.button(a)};this.arrayRemove=function(a,b,c){c=a.slice((c||
+"%25").replace(/\+/g,"%2b").replace(/ /g,"%20").replace(/#/g,"%23").replace(/&/g,"%26")}var g=this;this.condCall=function(a,b,c){a[b]&&a[b](c)};this.gfxPath=function(a,b){function c(){var k=0,n=1,o;do{o="ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/".indexOf(b.charAt(d++));k+=(o&31)*n;n*=32}while(o&32);return k%2?-(k+1)/2:k/2}for(var d=0,e=b.length,f=0,h=0;d<e;){for(var i=c(),j=[],l=0,m=i==2?3:1;l<m;++l){f+=c();h+=c();j.push(f/1E3,h/1E3)}if(i==0)a.moveTo(j[0],j[1]);else i==1?a.lineTo(j[0],j[1]):a.bezierCurveTo(j[0],j[1],j[2],j[3],j[4],j[5])}};this.buttons=0;this.button=function(a){return a.which?a.which==3?4:a.which==2?2:1:g.isIE&&typeof a.button!="undefined"?a.button==2?4:a.button==4?2:1:typeof a.button!="undefined"?a.button==2?4:a.button==1?2:1:0};this.mouseDown=function(a){g.buttons|=g.button(a)};this.mouseUp=function(a){g.buttons&=~g.button(a)};this.arrayRemove=function(a,b,c){c=a.slice((c||
 b)+1||a.length);a.length=b<0?a.length+b:b;return a.push.apply(a,c)};this.addAll=function(a,b){for(var c=0,h=b.length;c<h;++c)a.push(b[c])};var T=function(){for(var a,b=3,c=document.createElement("div"),h=c.getElementsByTagName("i");c.innerHTML="<!--[if gt IE "+ ++b+"]><i></i><![endif]--\>",h[0];);return b>4?b:a}(),R=navigator.userAgent.toLowerCase();this.isIE=T!==undefined;this.isIE6=T===6;this.isIElt9=T<9;this.isIEMobile=R.indexOf("msie 4")!=-1||R.indexOf("msie 5")!=-1;this.isOpera=typeof window.opera!==
 "undefined";this.isAndroid=R.indexOf("safari")!=-1&&R.indexOf("android")!=-1;this.isWebKit=R.indexOf("applewebkit")!=-1;this.isGecko=R.indexOf("gecko")!=-1&&!this.isWebKit;this.updateDelay=this.isIE?10:51;if(this.isAndroid){console.error("init console.error");console.info("init console.info");console.log("init console.log");console.warn("init console.warn")}var Z=new Date;this.trace=function(a,b){if(b)Z=new Date;b=new Date;b=(b.getMinutes()-Z.getMinutes())*6E4+(b.getSeconds()-Z.getSeconds())*1E3+
 (b.getMilliseconds()-Z.getMilliseconds());window.console&&console.log("["+b+"]: "+a)};this.initAjaxComm=function(a,b){function c(m,j){var o=null,s=true;if(window.XMLHttpRequest){o=new XMLHttpRequest;if(h)if("withCredentials"in o){if(j){o.open(m,j,true);o.withCredentials="true"}}else if(typeof XDomainRequest!="undefined"){o=new XDomainRequest;if(j){s=false;try{o.open(m,j+"&contentType=x-www-form-urlencoded")}catch(t){o=null}}}else o=null;else j&&o.open(m,j,true)}else if(!h&&window.ActiveXObject){try{o=
@@ -0,0 +1,169 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2012 Emweb bvba, Kessel-Lo, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef TEST_REQUEST_H_
+#define TEST_REQUEST_H_
+
+#include "web/WebRequest.h"
+
+#ifdef WT_THREADED
+#include <boost/thread.hpp>
+#endif // WT_THREADED
+
+#include <map>
+#include <sstream>
+#include <string>
+
+/*
+ * A GET request for a static resource (see WServer::addResource()),
+ * to be passed to WebController::handleRequest().
+ *
+ * The request records the response, and holds on to the callback of
+ * a flush until resume() is called.
+ */
+class TestRequest : public Wt::WebResponse
+{
+public:
+  TestRequest(const std::string& path)
+    : status_(200),
+      done_(false),
+      path_(path)
+  { }
+
+  virtual ~TestRequest() { }
+
+  void setHeaderValue(const std::string& name, const std::string& value)
+  {
+    requestHeaders_[name] = value;
+  }
+
+  bool done()
+  {
+#ifdef WT_THREADED
+    boost::mutex::scoped_lock lock(mutex_);
+#endif // WT_THREADED
+
+    return done_;
+  }
+
+#ifdef WT_THREADED
+  // Waits until the response is done, for at most 5 seconds
+  bool waitDone()
+  {
+    for (int i = 0; i < 500; ++i) {
+      if (done())
+	return true;
+      boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+    }
+
+    return false;
+  }
+#endif // WT_THREADED
+
+  bool flushing()
+  {
+#ifdef WT_THREADED
+    boost::mutex::scoped_lock lock(mutex_);
+#endif // WT_THREADED
+
+    return !callback_.empty();
+  }
+
+  // Completes a pending flush
+  void resume()
+  {
+    CallbackFunction callback;
+
+    {
+#ifdef WT_THREADED
+      boost::mutex::scoped_lock lock(mutex_);
+#endif // WT_THREADED
+
+      callback = callback_;
+      callback_ = CallbackFunction();
+    }
+
+    callback();
+  }
+
+  int status() const { return status_; }
+  std::string body() const { return out_.str(); }
+
+  std::string responseHeader(const std::string& name) const
+  {
+    std::map<std::string, std::string>::const_iterator i
+      = responseHeaders_.find(name);
+
+    return i != responseHeaders_.end() ? i->second : std::string();
+  }
+
+  virtual void flush(ResponseState state, CallbackFunction callback)
+  {
+#ifdef WT_THREADED
+    boost::mutex::scoped_lock lock(mutex_);
+#endif // WT_THREADED
+
+    if (state == ResponseDone)
+      done_ = true;
+    else
+      callback_ = callback;
+  }
+
+  virtual std::istream& in() { return in_; }
+  virtual std::ostream& out() { return out_; }
+  virtual std::ostream& err() { return out_; }
+
+  virtual void setRedirect(const std::string& url) { }
+  virtual void setStatus(int status) { status_ = status; }
+
+  virtual void setContentType(const std::string& value)
+  {
+    responseHeaders_["Content-Type"] = value;
+  }
+
+  virtual void setContentLength(::int64_t length) { }
+
+  virtual void addHeader(const std::string& name, const std::string& value)
+  {
+    responseHeaders_[name] = value;
+  }
+
+  virtual std::string envValue(const std::string& name) const
+  {
+    return std::string();
+  }
+
+  virtual std::string serverName() const { return "localhost"; }
+  virtual std::string serverPort() const { return "80"; }
+  virtual std::string scriptName() const { return path_; }
+  virtual std::string requestMethod() const { return "GET"; }
+  virtual std::string queryString() const { return std::string(); }
+  virtual std::string pathInfo() const { return std::string(); }
+  virtual std::string remoteAddr() const { return "127.0.0.1"; }
+  virtual std::string urlScheme() const { return "http"; }
+
+  virtual std::string headerValue(const std::string& name) const
+  {
+    std::map<std::string, std::string>::const_iterator i
+      = requestHeaders_.find(name);
+
+    return i != requestHeaders_.end() ? i->second : std::string();
+  }
+
+private:
+#ifdef WT_THREADED
+  boost::mutex mutex_;
+#endif // WT_THREADED
+
+  int status_;
+  bool done_;
+  std::string path_;
+  std::stringstream in_, out_;
+  std::map<std::string, std::string> requestHeaders_, responseHeaders_;
+  CallbackFunction callback_;
+};
+
+#endif // TEST_REQUEST_H_